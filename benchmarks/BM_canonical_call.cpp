@@ -0,0 +1,91 @@
+/**@file        benchmarks/BM_canonical_call.cpp
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// Benchmark: code size when a same function is called with all the
+// permutations of its parameters.
+//
+// This file is compiled twice:
+// - BM_canonical_call_direct: the function is called directly, and each
+//   permutation instantiates it,
+// - BM_canonical_call_sorted: the function is called through
+//   na::canonical_call(), and all the permutations share one instance.
+// Each executable reports the number of instances of the function.
+#include "named-parameters.hpp"
+#include <cmath>
+#include <cstdio>
+
+#if defined(__GNUC__)
+#   define NA_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#   define NA_NOINLINE __declspec(noinline)
+#else
+#   define NA_NOINLINE
+#endif
+
+using namespace na::literals;
+
+int nb_instances = 0;
+
+struct body
+{
+    template <typename ...Args>
+    NA_NOINLINE
+    double operator()(Args&& ...args) const
+    {
+        static int const id = ++nb_instances;
+        (void) id;
+        auto const& a = na::get("a"_na      , std::forward<Args>(args)...);
+        auto        b = na::get("b"_na = 1  , std::forward<Args>(args)...);
+        auto        c = na::get("c"_na = 0.5, std::forward<Args>(args)...);
+        auto        d = na::get("d"_na      , std::forward<Args>(args)...);
+        double res = 0;
+        for (int i = 0; i < d; ++i) {
+            res += std::sqrt(a * i + b) / (c + i);
+            if (res > 1e6) res = std::fmod(res, 1e6);
+        }
+        return res;
+    }
+};
+
+#if NA_BENCH_CANONICAL
+#   define CALL(...) na::canonical_call(body{}, __VA_ARGS__)
+#else
+#   define CALL(...) body{}(__VA_ARGS__)
+#endif
+
+int main(int argc, char **)
+{
+    double const x = argc * 1.5;
+    int    const n = argc * 100;
+    double sum = 0;
+    sum += CALL("a"_na = x, "b"_na = 2, "c"_na = 1.5, "d"_na = n);
+    sum += CALL("a"_na = x, "b"_na = 2, "d"_na = n, "c"_na = 1.5);
+    sum += CALL("a"_na = x, "c"_na = 1.5, "b"_na = 2, "d"_na = n);
+    sum += CALL("a"_na = x, "c"_na = 1.5, "d"_na = n, "b"_na = 2);
+    sum += CALL("a"_na = x, "d"_na = n, "b"_na = 2, "c"_na = 1.5);
+    sum += CALL("a"_na = x, "d"_na = n, "c"_na = 1.5, "b"_na = 2);
+    sum += CALL("b"_na = 2, "a"_na = x, "c"_na = 1.5, "d"_na = n);
+    sum += CALL("b"_na = 2, "a"_na = x, "d"_na = n, "c"_na = 1.5);
+    sum += CALL("b"_na = 2, "c"_na = 1.5, "a"_na = x, "d"_na = n);
+    sum += CALL("b"_na = 2, "c"_na = 1.5, "d"_na = n, "a"_na = x);
+    sum += CALL("b"_na = 2, "d"_na = n, "a"_na = x, "c"_na = 1.5);
+    sum += CALL("b"_na = 2, "d"_na = n, "c"_na = 1.5, "a"_na = x);
+    sum += CALL("c"_na = 1.5, "a"_na = x, "b"_na = 2, "d"_na = n);
+    sum += CALL("c"_na = 1.5, "a"_na = x, "d"_na = n, "b"_na = 2);
+    sum += CALL("c"_na = 1.5, "b"_na = 2, "a"_na = x, "d"_na = n);
+    sum += CALL("c"_na = 1.5, "b"_na = 2, "d"_na = n, "a"_na = x);
+    sum += CALL("c"_na = 1.5, "d"_na = n, "a"_na = x, "b"_na = 2);
+    sum += CALL("c"_na = 1.5, "d"_na = n, "b"_na = 2, "a"_na = x);
+    sum += CALL("d"_na = n, "a"_na = x, "b"_na = 2, "c"_na = 1.5);
+    sum += CALL("d"_na = n, "a"_na = x, "c"_na = 1.5, "b"_na = 2);
+    sum += CALL("d"_na = n, "b"_na = 2, "a"_na = x, "c"_na = 1.5);
+    sum += CALL("d"_na = n, "b"_na = 2, "c"_na = 1.5, "a"_na = x);
+    sum += CALL("d"_na = n, "c"_na = 1.5, "a"_na = x, "b"_na = 2);
+    sum += CALL("d"_na = n, "c"_na = 1.5, "b"_na = 2, "a"_na = x);
+    std::printf("%-28s %3d instance(s)  (checksum: %g)\n",
+            NA_BENCH_NAME, nb_instances, sum);
+}
@@ -0,0 +1,52 @@
+/**@file        benchmarks/BM_proxy_storage.cpp
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// Microbenchmark: cost of passing small scalars to a function that isn't
+// inlined.
+//
+// This file is compiled twice:
+// - BM_proxy_storage_by_value: with the default by-value storage of small
+//   trivially copyable rvalues,
+// - BM_proxy_storage_by_ref: with NAMED_PARAMETERS_BY_VALUE_MAX_SIZE=0, i.e.
+//   the values are always referenced by the proxies.
+#include "named-parameters.hpp"
+#include <chrono>
+#include <cstdio>
+
+#if defined(__GNUC__)
+#   define NA_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#   define NA_NOINLINE __declspec(noinline)
+#else
+#   define NA_NOINLINE
+#endif
+
+using namespace na::literals;
+
+template <typename ...Args>
+NA_NOINLINE
+double f(Args&& ...args)
+{
+    auto n = na::get("n"_na       , std::forward<Args>(args)...);
+    auto x = na::get("x"_na = 1.0 , std::forward<Args>(args)...);
+    auto y = na::get("y"_na = 0.5 , std::forward<Args>(args)...);
+    return n * x + y;
+}
+
+int main()
+{
+    constexpr long nb_iterations = 200000000;
+    auto const start = std::chrono::steady_clock::now();
+    double sum = 0;
+    for (long i = 0; i != nb_iterations; ++i) {
+        sum += f("x"_na = 12.5, "n"_na = static_cast<int>(i & 0xff), "y"_na = 0.25 * (i & 1));
+    }
+    auto const stop = std::chrono::steady_clock::now();
+    auto const ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    std::printf("%-28s %8.3f ns/call  (checksum: %g)\n",
+            NA_BENCH_NAME, ns / nb_iterations, sum);
+}
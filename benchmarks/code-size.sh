@@ -0,0 +1,14 @@
+#!/bin/sh
+# Code size benchmark: size of the text section of executables.
+#
+# Usage: code-size.sh executable...
+
+printf "%-28s %12s\n" "executable" "text (bytes)"
+for exe in "$@" ; do
+    if command -v size > /dev/null 2>&1 ; then
+        text=$(size "$exe" | awk 'NR==2 { print $1 }')
+    else
+        text=$(wc -c < "$exe")
+    fi
+    printf "%-28s %12s\n" "$(basename "$exe")" "$text"
+done
@@ -0,0 +1,40 @@
+#!/bin/sh
+# Compile-time benchmark: preprocessing and parsing costs of translation units.
+#
+# Usage: CXX=g++ RUNS=10 compile-time.sh [compiler flags...] -- file.cpp...
+#
+# For each file, reports the average time (in ms) spent by "$CXX -E", the number
+# of lines it produces, and the average time spent by "$CXX -fsyntax-only".
+
+CXX=${CXX:-c++}
+RUNS=${RUNS:-10}
+
+flags=""
+while [ $# -gt 0 ] && [ "$1" != "--" ] ; do
+    flags="$flags $1"
+    shift
+done
+[ "$1" = "--" ] && shift
+
+now_ns() { date +%s%N ; }
+
+# $1: compiler mode flag, $2: file -> average duration in ms
+average() {
+    start=$(now_ns)
+    i=0
+    while [ $i -lt "$RUNS" ] ; do
+        # shellcheck disable=SC2086
+        "$CXX" $flags "$1" "$2" -o /dev/null 2>/dev/null || return 1
+        i=$((i+1))
+    done
+    echo $(( ($(now_ns) - start) / RUNS / 1000000 ))
+}
+
+printf "%-28s %12s %12s %12s\n" "TU" "PP (ms)" "PP lines" "parse (ms)"
+for tu in "$@" ; do
+    # shellcheck disable=SC2086
+    lines=$("$CXX" $flags -E "$tu" 2>/dev/null | wc -l)
+    pp=$(average -E "$tu") || { echo "$tu: preprocessing failed" >&2 ; exit 1 ; }
+    parse=$(average -fsyntax-only "$tu") || { echo "$tu: compilation failed" >&2 ; exit 1 ; }
+    printf "%-28s %12s %12s %12s\n" "$(basename "$tu")" "$pp" "$lines" "$parse"
+done
@@ -0,0 +1,10 @@
+/**@file        benchmarks/compile-time/CT_core.cpp
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// Compile-time benchmark: core header only.
+#include "named-parameters.hpp"
+#include "CT_usage.hpp"
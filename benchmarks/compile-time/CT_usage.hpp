@@ -0,0 +1,28 @@
+/**@file        benchmarks/compile-time/CT_usage.hpp
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// Typical use of named parameters shared by the compile-time benchmarks, in
+// order to compare only the cost of the headers included beforehand.
+
+using namespace na::literals;
+
+template <typename ...Args>
+int f(Args&& ...args)
+{
+    auto a = na::get("a"_na = 1   , std::forward<Args>(args)...);
+    auto b = na::get("b"_na       , std::forward<Args>(args)...);
+    auto c = na::get("c"_na = 2.5 , std::forward<Args>(args)...);
+    auto d = na::get("d"_na       , std::forward<Args>(args)...);
+    return static_cast<int>(a + b + c + d);
+}
+
+int main()
+{
+    int i = 4;
+    return f("d"_na = 12.5, "b"_na = i)
+        +  f("b"_na = 1, "a"_na = 2, "d"_na = 3, "c"_na = 4.);
+}
@@ -0,0 +1,61 @@
+/**@file        named-parameters-string.hpp
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#ifndef NAMED_PARAMETERS_STRING_HPP
+#define NAMED_PARAMETERS_STRING_HPP
+
+#include "named-parameters.hpp"
+#include <ostream>
+#include <string>
+
+// String and stream helpers for named parameters.
+//
+// They are kept out of named-parameters.hpp in order to keep the core header
+// free of any dependency to <string> and <iostream>: only the translation
+// units that really need to display parameter names pay for them.
+
+namespace na
+{ // named arguments
+    /// Name of a parameter kind, as a string.
+    template <class CharT, CharT...string>
+        inline
+        std::basic_string<CharT> name(literals::string_literal<CharT, string...> const&)
+        { return {string...}; }
+
+    /// Name of a parameter actually passed, as a string.
+    template <typename T, class CharT, CharT...string>
+        inline
+        std::basic_string<CharT> name(literals::proxy<T, CharT, string...> const&)
+        { return {string...}; }
+
+    namespace literals
+    {
+        // Both operators are found through ADL.
+        template <class CharT, class Traits, CharT...string>
+            inline
+            std::basic_ostream<CharT, Traits>& operator<<(
+                    std::basic_ostream<CharT, Traits>& os,
+                    string_literal<CharT, string...> const& p)
+            {
+                return os << na::name(p);
+            }
+
+        /// Displays "name=value".
+        template <class CharT, class Traits, typename T, CharT...string>
+            inline
+            std::basic_ostream<CharT, Traits>& operator<<(
+                    std::basic_ostream<CharT, Traits>& os,
+                    proxy<T, CharT, string...> const& p)
+            {
+                return os << na::name(p) << CharT('=') << p.value();
+            }
+    } // namespace literals
+} // na namespaces
+
+#endif // NAMED_PARAMETERS_STRING_HPP
+
+// Vim: let $CXXFLAGS='-std=c++14 -Wno-gnu-string-literal-operator-template'
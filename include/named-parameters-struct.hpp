@@ -0,0 +1,189 @@
+/**@file        named-parameters-struct.hpp
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#ifndef NAMED_PARAMETERS_STRUCT_HPP
+#define NAMED_PARAMETERS_STRUCT_HPP
+
+#include "named-parameters.hpp"
+#include <tuple>
+
+// Materialization of named arguments into plain aggregates.
+//
+// The fields of the aggregate are described once, with a constexpr function
+// named `na_fields()` found by ADL:
+//
+//     struct Options {
+//         int         n = 4;
+//         double      x = 12.5;
+//         std::string s;
+//     };
+//     constexpr auto na_fields(na::type_tag<Options>) {
+//         using namespace na::literals;
+//         return na::fields(
+//             na::field   ("n"_na, &Options::n),
+//             na::field   ("x"_na, &Options::x),
+//             na::required("s"_na, &Options::s));
+//     }
+//
+//     template <typename ...Args> void f(Args&& ...args) {
+//         auto const opt = na::to_struct<Options>(std::forward<Args>(args)...);
+//         g(opt); // non-template code
+//     }
+//
+// - Optional fields keep the value of their default member initializer when
+//   they aren't passed.
+// - Required fields, parameters passed several times, and parameters not
+//   compatible with the fields are diagnosed at compile time, as na::get()
+//   does.
+// - The mapping between parameters and fields is resolved at compile time,
+//   and the aggregate is built in one pass: each field is brace-initialized
+//   once, either from the value forwarded, or from its default value.
+//
+// Limitations:
+// - The fields shall be described in the declaration order of the members.
+//   Members left out shall come last, they keep their default member
+//   initializer. Fields described out of order are diagnosed, unless the
+//   members swapped have the same type.
+// - Default values are copied from a value-initialized instance of the
+//   aggregate. Hence, the aggregate shall be value-initializable when it has
+//   optional fields.
+// - Arithmetic values are converted to the type of their field, they aren't
+//   rejected as narrowing conversions.
+// - Reference members cannot be described, as there is no pointer to them.
+
+namespace na
+{ // named arguments
+    /// Tag used to find the field descriptor of a type through ADL.
+    template <typename T> struct type_tag { using type = T; };
+
+    /// Binds a parameter kind to a data member.
+    template <typename ArgType, typename MemberPtr, bool Mandatory>
+        struct field_descriptor
+        {
+            using ArgumentTypeId = ArgType;
+            static constexpr bool mandatory = Mandatory;
+            MemberPtr member;
+        };
+
+    /// Optional field: its default value is its default member initializer.
+    template <typename CharT, CharT...string, typename C, typename M>
+        constexpr
+        field_descriptor<literals::string_literal<CharT, string...>, M C::*, false>
+        field(literals::string_literal<CharT, string...> const&, M C::* member)
+        { return {member}; }
+
+    /// Mandatory field.
+    template <typename CharT, CharT...string, typename C, typename M>
+        constexpr
+        field_descriptor<literals::string_literal<CharT, string...>, M C::*, true>
+        required(literals::string_literal<CharT, string...> const&, M C::* member)
+        { return {member}; }
+
+    /// Field descriptor of a type.
+    template <typename... Fields>
+        constexpr
+        std::tuple<Fields...> fields(Fields... fs)
+        { return std::tuple<Fields...>{fs...}; }
+
+    namespace internals
+    {
+        template <typename MemberPtr> struct member_type;
+        template <typename C, typename M> struct member_type<M C::*> { using type = M; };
+
+        /// Value-initialized instance from which default values are copied.
+        template <typename Struct>
+            inline
+            Struct const& prototype()
+            {
+                static Struct const proto{};
+                return proto;
+            }
+
+        /// Arithmetic values are converted explicitly: brace-initialization
+        /// would reject narrowing conversions.
+        template <typename M, typename V>
+            constexpr
+            std::enable_if_t<std::is_arithmetic<M>::value, std::remove_cv_t<M>>
+            as_field(V&& v)
+            { return static_cast<std::remove_cv_t<M>>(std::forward<V>(v)); }
+
+        template <typename M, typename V>
+            constexpr
+            std::enable_if_t<!std::is_arithmetic<M>::value, V&&>
+            as_field(V&& v)
+            { return std::forward<V>(v); }
+
+        // Optional field => default value from the prototype
+        template <typename Struct, typename Field, typename... Args>
+            inline
+            decltype(auto) field_value(Field const& f, std::false_type, Args&&... args)
+            {
+                using ArgType = typename Field::ArgumentTypeId;
+                using M = typename member_type<decltype(Field::member)>::type;
+                return as_field<M>(na::get(ArgType{} = prototype<Struct>().*f.member, std::forward<Args>(args)...));
+            }
+
+        // Mandatory field => na::get() diagnoses its absence
+        template <typename Struct, typename Field, typename... Args>
+            inline
+            decltype(auto) field_value(Field const&, std::true_type, Args&&... args)
+            {
+                using ArgType = typename Field::ArgumentTypeId;
+                using M = typename member_type<decltype(Field::member)>::type;
+                return as_field<M>(na::get(ArgType{}, std::forward<Args>(args)...));
+            }
+
+        template <typename Fields> struct has_unique_fields;
+        template <typename... Fields>
+            struct has_unique_fields<std::tuple<Fields...>>
+            : all_of<(nb_instances<typename Fields::ArgumentTypeId, Fields...>::value == 1)...>
+            {};
+
+        /// Tells whether the members bound to the fields can be the leading
+        /// members of \c Struct, in the same order.
+        template <typename Struct, typename Fields, typename = void>
+            struct are_ordered_fields : std::false_type {};
+        template <typename Struct, typename... Fields>
+            struct are_ordered_fields<Struct, std::tuple<Fields...>, void_t<decltype(Struct{
+                    std::declval<typename member_type<decltype(Fields::member)>::type>()...
+                    })>>
+            : std::true_type {};
+
+        template <typename Struct, typename Fields, std::size_t... I, typename... Args>
+            inline
+            Struct build_struct(Fields const& fs, std::index_sequence<I...>, Args&&... args)
+            {
+                return Struct{ field_value<Struct>(
+                        std::get<I>(fs),
+                        std::integral_constant<bool, std::tuple_element<I, Fields>::type::mandatory>{},
+                        std::forward<Args>(args)...)... };
+            }
+    } // internals namespace
+
+    /**
+     * Builds a \c Struct from named arguments.
+     * The fields of \c Struct are described by `na_fields(na::type_tag<Struct>)`.
+     */
+    template <typename Struct, typename... Args>
+        inline
+        Struct to_struct(Args&&... args)
+        {
+            constexpr auto fs = na_fields(type_tag<Struct>{});
+            using Fields = typename std::remove_const<decltype(fs)>::type;
+            static_assert(internals::has_unique_fields<Fields>::value,
+                    "Several fields cannot be bound to a same parameter");
+            static_assert(internals::are_ordered_fields<Struct, Fields>::value,
+                    "Fields shall be described in the declaration order of the members");
+            return internals::build_struct<Struct>(fs,
+                    std::make_index_sequence<std::tuple_size<Fields>::value>{},
+                    std::forward<Args>(args)...);
+        }
+} // na namespaces
+
+#endif // NAMED_PARAMETERS_STRUCT_HPP
+
+// Vim: let $CXXFLAGS='-std=c++14 -Wno-gnu-string-literal-operator-template'
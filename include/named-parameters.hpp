@@ -8,7 +8,8 @@
 #ifndef NAMED_PARAMETERS_HPP
 #define NAMED_PARAMETERS_HPP
 
-#include <string>
+#include <cstddef>     // size_t
+#include <initializer_list>
 #include <type_traits>
 #include <utility>     //  move, forward
 
@@ -19,11 +20,16 @@
 //   - Everything is meant to be done at compile time
 //   - No dynamic allocation is done
 //   - Rely on perfect forwarding to move or reference things
+//   - Small trivially copyable rvalues are stored by value
 // - No macros
 // - Simple to use:
 //   - the end-user doesn't need to define manually type for each possible
 //     argument, this is done automagically thanks to C++11 user-defined literals
 //   - only one function to fetch argument values, with or without default values
+// - Light:
+//   - this core header doesn't depend on <string> nor <iostream>; helpers
+//     that need them live in named-parameters-string.hpp
+//   - a C++20 module interface (named_parameters) wraps this header
 // - As close to C++11 as possible
 //   - Unfortunatelly that wasn't possible, for simplicity reasons, this is a
 //     C++14 code, that rely on a non-standard extension of gcc and clang.
@@ -32,10 +38,12 @@
 //   - non copiable types
 //   - moved stuff
 //   - default values
+//   - compile-time flags
 // - Errors are detected at compilation time
 //   - multiple instanciation of a same parameter
 //   - missing mandatory parameters
 //   - default values not compatibles with parameters
+//   - run-time values passed to compile-time flags
 //
 // # Todo:
 // - permit to force the result type in get<>
@@ -54,29 +62,116 @@ struct indenter {
 };
 #endif
 
-namespace na
+// When this header is wrapped into the C++20 module interface unit, every
+// declaration is exported.
+#ifndef NAMED_PARAMETERS_EXPORT
+#   define NAMED_PARAMETERS_EXPORT
+#endif
+
+// Variables defined in headers are inline when the language permits it. This is
+// required to export them from the C++20 module.
+#if defined(__cpp_inline_variables)
+#   define NAMED_PARAMETERS_INLINE_VARIABLE inline
+#else
+#   define NAMED_PARAMETERS_INLINE_VARIABLE
+#endif
+
+// Size limit (in bytes) under which rvalues of trivially copyable types are
+// stored by value in proxies. 0 stores everything by reference.
+// NB: All the translation units of a program shall use the same value.
+#ifndef NAMED_PARAMETERS_BY_VALUE_MAX_SIZE
+#   define NAMED_PARAMETERS_BY_VALUE_MAX_SIZE (2 * sizeof(void*))
+#endif
+
+NAMED_PARAMETERS_EXPORT namespace na
 { // named arguments
+    /**
+     * Tells whether a proxy stores its value by value instead of by reference.
+     * Only small and trivially copyable rvalues are concerned: the callee
+     * then reads them from the proxy with one indirection less, while lvalues
+     * shall still be referenced.
+     * NB: proxies are still passed by reference, the values aren't kept in
+     * registers when the callee isn't inlined.
+     */
+    template <typename T> struct is_stored_by_value
+        : std::integral_constant<bool,
+          ! std::is_reference<T>::value
+          && ! std::is_const<T>::value
+          && ! std::is_volatile<T>::value
+          && ! std::is_array<T>::value
+          && std::is_trivially_copyable<T>::value
+          && sizeof(T) <= NAMED_PARAMETERS_BY_VALUE_MAX_SIZE>
+        {};
+
+    // Compile-time flags
+    /**
+     * Compile-time constant to pass as a parameter value or as a default
+     * value:
+     * \code
+     * f("checked"_na = na::static_flag<bool, true>);
+     * ...
+     * auto checked = na::get("checked"_na = na::static_flag<bool, false>, args...);
+     * \endcode
+     * \c na::get() returns a \c std::integral_constant, and the callee can be
+     * specialized at compile time on its value.
+     * When the default value is a compile-time constant, the parameter
+     * passed shall also be one.
+     */
+    template <typename T, T v>
+        NAMED_PARAMETERS_INLINE_VARIABLE
+        constexpr std::integral_constant<T, v> static_flag{};
+
+#if defined(__cpp_nontype_template_parameter_auto)
+    /// Shorter form of \c na::static_flag: `"checked"_na = na::c<true>`.
+    template <auto v>
+        NAMED_PARAMETERS_INLINE_VARIABLE
+        constexpr std::integral_constant<decltype(v), v> c{};
+#endif
+
+    namespace internals
+    {
+        template <typename T, bool ByValue = is_stored_by_value<T>::value>
+            struct proxy_storage
+            {
+                constexpr proxy_storage(T&& v) : m_v(std::forward<T>(v)) {}
+                constexpr T&& value() const { return std::forward<T>(m_v); }
+
+            private:
+                T && m_v;
+            };
+
+        template <typename T> struct proxy_storage<T, true>
+        {
+            constexpr proxy_storage(T&& v) : m_v(std::move(v)) {}
+            // The value is seen as an rvalue, as it would have been through
+            // a reference, unless the proxy is const.
+            constexpr T&& value() { return std::move(m_v); }
+            constexpr T const& value() const { return m_v; }
+
+        private:
+            T m_v;
+        };
+    } // internals namespace
+
     namespace literals
     {
         template <class CharT, CharT...string> struct string_literal;
 
         template <typename T, class CharT, CharT...string> struct proxy
+            : private internals::proxy_storage<T>
         {
             using ArgumentTypeId = string_literal<CharT, string...>;
             using ArgumentType   = T;
+            static constexpr bool stored_by_value = is_stored_by_value<T>::value;
 
-            constexpr proxy(T&& v) : m_v(std::forward<T>(v)) {}
-            static constexpr std::basic_string<CharT> name() { return {string...}; }
-            constexpr T&& value() const { return std::forward<T>(m_v); }
-
-        private:
-            T && m_v;
+            constexpr proxy(T&& v) : internals::proxy_storage<T>(std::forward<T>(v)) {}
+            using internals::proxy_storage<T>::value;
         };
 
         template <class CharT, CharT...string> struct string_literal
         {
             static constexpr CharT raw_name[] = {string...};
-            static constexpr std::basic_string<CharT> name() { return {string...}; }
+            static constexpr std::size_t size = sizeof...(string);
 
             template <typename T>
             proxy<T, CharT, string...> operator=(T&& value) const {
@@ -85,11 +180,100 @@ namespace na
             }
         };
 
+        // Definitions required by C++14 when the static members are odr-used
+        template <class CharT, CharT...string>
+            constexpr CharT string_literal<CharT, string...>::raw_name[];
+        template <class CharT, CharT...string>
+            constexpr std::size_t string_literal<CharT, string...>::size;
+        template <typename T, class CharT, CharT...string>
+            constexpr bool proxy<T, CharT, string...>::stored_by_value;
+
+        /// Proxy to an output parameter: see \c na::out()
+        template <typename T, class CharT, CharT...string> struct out_proxy
+            : proxy<T, CharT, string...>
+        {
+            using proxy<T, CharT, string...>::proxy;
+        };
+
         template <class CharT, CharT...string>
             constexpr string_literal<CharT, string...> operator""_na()
             { return {}; }
     } // namespace literals
 
+    // Output parameters
+    /**
+     * Handle to an output parameter the caller has requested.
+     * Assigning to it writes directly into the caller storage.
+     */
+    template <typename T> struct output
+    {
+        static constexpr bool requested = true;
+
+        constexpr explicit output(T& v) : m_v(&v) {}
+        constexpr explicit operator bool() const { return true; }
+        T& operator*() const { return *m_v; }
+        T* operator->() const { return m_v; }
+
+        // Copying a handle binds the copy to the same parameter, while
+        // assigning a handle to another one writes through: handles are
+        // never rebound.
+        constexpr output(output const&) = default;
+        output const& operator=(output const& o) const
+        {
+            *m_v = *o;
+            return *this;
+        }
+
+        template <typename U,
+                 typename = std::enable_if_t<!std::is_same<std::decay_t<U>, output>::value>>
+            output const& operator=(U&& v) const
+            {
+                *m_v = std::forward<U>(v);
+                return *this;
+            }
+
+    private:
+        T * m_v;
+    };
+
+    /**
+     * Handle to an output parameter the caller hasn't requested.
+     * Assignments are ignored.
+     * NB: This is a template only to permit the definition of \c requested
+     * in this header, see \c na::no_output.
+     */
+    template <typename = void> struct basic_no_output
+    {
+        static constexpr bool requested = false;
+
+        constexpr explicit operator bool() const { return false; }
+
+        template <typename U>
+            basic_no_output const& operator=(U&&) const { return *this; }
+    };
+
+    using no_output = basic_no_output<>;
+
+    // Definitions required by C++14 when the static members are odr-used
+    template <typename T> constexpr bool output<T>::requested;
+    template <typename T> constexpr bool basic_no_output<T>::requested;
+
+    /**
+     * Calls \c f with a reference to the output parameter, only if it has
+     * been requested.
+     * When it hasn't, \c f isn't even instantiated if it's a generic lambda:
+     * the code that computes the output is skipped at compile time.
+     */
+    template <typename T, typename F>
+        inline
+        void if_requested(output<T> const& o, F&& f)
+        { std::forward<F>(f)(*o); }
+
+    template <typename F>
+        inline
+        void if_requested(no_output const&, F&&)
+        {}
+
     namespace internals
     {
 #if 0
@@ -122,7 +306,30 @@ namespace na
 
         struct no_default {};
 
-        template <typename T> struct get_arg_typeid {
+        template <typename T> struct is_static_flag : std::false_type {};
+        template <typename T, T v>
+            struct is_static_flag<std::integral_constant<T, v>> : std::true_type {};
+
+        template <typename Default, typename Arg,
+                 bool = is_static_flag<Default>::value,
+                 bool = is_static_flag<Arg>::value>
+            struct are_compatible : has_common<Default, Arg> {};
+
+        // Two compile-time flags are compatible when their values are.
+        template <typename Default, typename Arg>
+            struct are_compatible<Default, Arg, true, true>
+            : has_common<typename Default::value_type, typename Arg::value_type> {};
+
+        // A run-time value where a compile-time flag is expected is
+        // reported by a dedicated assertion.
+        template <typename Default, typename Arg>
+            struct are_compatible<Default, Arg, true, false> : std::true_type {};
+
+        // Arguments that aren't named (packs...) have no ArgumentTypeId.
+        template <typename T, typename = void> struct get_arg_typeid {
+            using type = void;
+        };
+        template <typename T> struct get_arg_typeid<T, void_t<typename T::ArgumentTypeId>> {
             using type = typename T::ArgumentTypeId;
         };
         template <typename T> struct clean_type {
@@ -141,6 +348,31 @@ namespace na
             : std::is_same<ArgType, typename get_arg_typeid<typename clean_type<Arg0>::type>::type>
             {};
 
+        /// Tells whether a pack of parameters contains a parameter kind, see
+        /// \c na::pack().
+        template <typename Layer, typename ArgType> struct contains : std::false_type {};
+
+        /// Tells whether an argument is a pack of parameters.
+        template <typename T> struct is_layered : std::false_type {};
+
+        /// Tells whether none of the arguments is a pack of parameters.
+        template <typename... Args> struct has_no_layer
+            : std::is_same<
+              std::integer_sequence<bool, false, is_layered<typename clean_type<Args>::type>::value...>,
+              std::integer_sequence<bool, is_layered<typename clean_type<Args>::type>::value..., false>>
+            {};
+
+        /// Tells whether a parameter kind is passed somewhere in \c Args,
+        /// directly or within packs.
+        template <typename ArgType, typename... Args>
+            struct is_passed : std::false_type{};
+        template <typename ArgType, typename Arg0, typename... Args>
+            struct is_passed<ArgType, Arg0, Args...>
+            : std::conditional<head_is_matching<ArgType, Arg0>::value
+                || contains<typename clean_type<Arg0>::type, ArgType>::value,
+                std::true_type, is_passed<ArgType, Args...>>::type
+            {};
+
         template <typename... T> struct wrong_t {
             static constexpr bool value = false;
         };
@@ -167,15 +399,25 @@ namespace na
             auto && get_impl(Default&& /*default_*/, std::true_type, Arg0&& head, Args&&... tail)
             {
                 static_assert(head_is_matching<ArgType, Arg0>::value, "hey!");
+                // The proxy may be an lvalue
+                using Proxy = typename clean_type<Arg0>::type;
+                using D = typename clean_type<Default>::type;
+                using A = typename clean_type<typename Proxy::ArgumentType>::type;
                 static_assert(
                         doesnt_have_a_default<Default>::value ||
-                        has_common<typename clean_type<Default>::type, typename clean_type<typename Arg0::ArgumentType>::type>::value,
+                        ! is_static_flag<D>::value || is_static_flag<A>::value,
+                        "This parameter expects a compile-time constant, see na::static_flag");
+                static_assert(
+                        doesnt_have_a_default<Default>::value ||
+                        are_compatible<D, A>::value,
                         "The parameter passed and the default value declared don't have compatible types!");
                 // std::cout << indent << "get<"<<ArgType::name()<<">("<<Arg0::name() << ", ...) -> head:"<<"\n";
                 // check there is no other instanciation of the
                 // parameter
                 check_no_other_instanciation(ArgType{}, std::forward<Args>(tail)...);
-                return std::forward<typename Arg0::ArgumentType>(head.value());
+                // value() already forwards the value, or gives a const
+                // lvalue when the proxy is const.
+                return head.value();
             }
 
         // End of recursion: past last element
@@ -197,6 +439,54 @@ namespace na
                 return Invalid::Type;
             }
 
+        template <typename T> struct is_output_proxy : std::false_type {};
+        template <typename T, typename CharT, CharT...string>
+            struct is_output_proxy<literals::out_proxy<T, CharT, string...>> : std::true_type {};
+
+        // Found an output parameter!
+        template <typename Arg0>
+            inline
+            auto make_output(Arg0&& head, std::true_type)
+            {
+                using Proxy = typename clean_type<Arg0>::type;
+                return output<typename std::remove_reference<typename Proxy::ArgumentType>::type>{head.value()};
+            }
+        // -> not passed through na::out(), the error has already been
+        // reported
+        template <typename Arg0>
+            inline
+            auto make_output(Arg0&&, std::false_type)
+            {
+                return no_output{};
+            }
+
+        template <typename ArgType, typename Arg0, typename... Args>
+            inline
+            auto get_out_impl(std::true_type, Arg0&& head, Args&&... tail)
+            {
+                using is_output = typename is_output_proxy<typename clean_type<Arg0>::type>::type;
+                static_assert(is_output::value, "Output parameters shall be passed through na::out()");
+                check_no_other_instanciation(ArgType{}, std::forward<Args>(tail)...);
+                return make_output(std::forward<Arg0>(head), is_output{});
+            }
+
+        // End of recursion: the output parameter isn't requested
+        template <typename ArgType>
+            inline
+            no_output get_out_impl(std::false_type)
+            {
+                return {};
+            }
+
+        // Not found => recurse
+        template <typename ArgType, typename Arg0, typename... Args>
+            inline
+            auto get_out_impl(std::false_type, Arg0&&, Args&&... tail)
+            {
+                using same_head = typename head_is_matching<ArgType, Args...>::type;
+                return get_out_impl<ArgType>(same_head{}, std::forward<Args>(tail)...);
+            }
+
         // Not found => recurse
         template <typename ArgType, typename Default, typename Arg0, typename... Args>
             inline
@@ -215,6 +505,8 @@ namespace na
         inline
         auto&& get(literals::string_literal<CharT, string...> const&, Args&&... args)
         {
+            static_assert(internals::has_no_layer<Args...>::value,
+                    "Packs of parameters shall be passed alone, see na::merge()");
             using ArgType = literals::string_literal<CharT, string...>;
             using same_head = typename internals::head_is_matching<ArgType, Args...>::type;
             return internals::get_impl<ArgType>(internals::no_default{}, same_head{}, std::forward<Args>(args)...);
@@ -224,11 +516,758 @@ namespace na
         inline
         auto&& get(literals::proxy<T, CharT, string...> const& default_, Args&&... args)
         {
+            static_assert(internals::has_no_layer<Args...>::value,
+                    "Packs of parameters shall be passed alone, see na::merge()");
             using ArgType = literals::string_literal<CharT, string...>;
             using same_head = typename internals::head_is_matching<ArgType, Args...>::type;
             return internals::get_impl<ArgType>(default_.value(), same_head{}, std::forward<Args>(args)...);
         }
 
+    /**
+     * Marks a parameter as an output parameter.
+     * It shall be bound to a modifiable lvalue:
+     * \code
+     * f(na::out("result"_na = buffer));
+     * \endcode
+     */
+    template <typename T, typename CharT, CharT...string>
+        inline
+        literals::out_proxy<T, CharT, string...> out(literals::proxy<T, CharT, string...> const& p)
+        {
+            static_assert(
+                    std::is_lvalue_reference<T>::value &&
+                    ! std::is_const<typename std::remove_reference<T>::type>::value,
+                    "An output parameter shall be bound to a modifiable lvalue");
+            return literals::out_proxy<T, CharT, string...>{p.value()};
+        }
+
+    /**
+     * Fetches an output parameter.
+     * @return a \c na::output<> handle to the caller storage if the output
+     * parameter has been passed, a \c na::no_output handle otherwise. Both
+     * handles define a static \c requested boolean.
+     */
+    template <typename CharT, CharT...string, typename... Args>
+        inline
+        auto get_out(literals::string_literal<CharT, string...> const&, Args&&... args)
+        {
+            static_assert(internals::has_no_layer<Args...>::value,
+                    "Packs of parameters shall be passed alone, see na::merge()");
+            using ArgType = literals::string_literal<CharT, string...>;
+            using same_head = typename internals::head_is_matching<ArgType, Args...>::type;
+            return internals::get_out_impl<ArgType>(same_head{}, std::forward<Args>(args)...);
+        }
+
+
+    /**
+     * Tells whether a parameter has been passed.
+     * @return \c std::true_type or \c std::false_type
+     */
+    template <typename CharT, CharT...string, typename... Args>
+        constexpr
+        auto is_set(literals::string_literal<CharT, string...> const&, Args&&...)
+        {
+            using ArgType = literals::string_literal<CharT, string...>;
+            return typename internals::is_passed<ArgType, Args...>::type{};
+        }
+
+    // Dispatch on the parameters passed
+    namespace internals
+    {
+        /// Implementation that requires the parameters \c ArgTypes.
+        template <typename F, typename... ArgTypes> struct candidate
+        {
+            F f;
+        };
+
+        /// Implementations passed without requirements are always viable.
+        template <typename F> struct as_candidate
+        {
+            using type = candidate<F>;
+            template <typename G>
+                static constexpr type make(G&& g) { return {std::forward<G>(g)}; }
+        };
+        template <typename F, typename... ArgTypes> struct as_candidate<candidate<F, ArgTypes...>>
+        {
+            using type = candidate<F, ArgTypes...>;
+            template <typename G>
+                static constexpr type make(G&& g) { return std::forward<G>(g); }
+        };
+
+        template <typename T> struct is_string_literal : std::false_type {};
+        template <typename CharT, CharT...string>
+            struct is_string_literal<literals::string_literal<CharT, string...>> : std::true_type {};
+
+        template <bool...> struct bool_pack {};
+        template <bool... b> struct all_of
+            : std::is_same<bool_pack<true, b...>, bool_pack<b..., true>> {};
+
+        /// Precedence of a candidate: its number of required parameters, or
+        /// -1 when they aren't all passed.
+        template <typename Candidate, typename... Args> struct score;
+        template <typename F, typename... ArgTypes, typename... Args>
+            struct score<candidate<F, ArgTypes...>, Args...>
+            : std::integral_constant<int,
+              all_of<is_passed<ArgTypes, Args...>::value...>::value
+              ? int(sizeof...(ArgTypes)) : -1>
+            {};
+
+        struct selection {
+            std::size_t index;
+            std::size_t nb_best;
+        };
+        constexpr selection select_best(std::initializer_list<int> scores)
+        {
+            selection res{0, 0};
+            int best = -1;
+            std::size_t i = 0;
+            for (int sc : scores) {
+                if (sc > best) {
+                    best = sc;
+                    res = selection{i, 1};
+                } else if (sc == best && sc >= 0) {
+                    ++res.nb_best;
+                }
+                ++i;
+            }
+            return res;
+        }
+
+        /**@name Storage of heterogeneous objects indexed at compile time
+         * @{
+         */
+        template <std::size_t I, typename T> struct holder
+        {
+            T value;
+        };
+
+        template <typename Indices, typename... Ts> struct indexed_storage;
+        template <std::size_t... I, typename... Ts>
+            struct indexed_storage<std::index_sequence<I...>, Ts...>
+            : holder<I, Ts>...
+            {
+                constexpr indexed_storage(Ts... ts)
+                    : holder<I, Ts>{std::forward<Ts>(ts)}...
+                    {}
+            };
+
+        template <std::size_t I, typename T>
+            constexpr
+            T const& get_holder(holder<I, T> const& h)
+            { return h.value; }
+
+        template <std::size_t I, typename T>
+            constexpr
+            T& get_holder(holder<I, T>& h)
+            { return h.value; }
+        //@}
+
+        template <typename... Candidates> struct overload_t
+        {
+            constexpr explicit overload_t(Candidates... cs)
+                : m_candidates(std::move(cs)...)
+                {}
+
+            template <typename... Args>
+                decltype(auto) operator()(Args&&... args) const
+                {
+                    return get_holder<best<Args...>()>(m_candidates).f(std::forward<Args>(args)...);
+                }
+
+            // Implementations with a non-const call operator (mutable
+            // lambdas...) can only be called from non-const overloads.
+            template <typename... Args>
+                decltype(auto) operator()(Args&&... args)
+                {
+                    return get_holder<best<Args...>()>(m_candidates).f(std::forward<Args>(args)...);
+                }
+
+        private:
+            template <typename... Args>
+                static constexpr std::size_t best()
+                {
+                    constexpr selection sel = select_best({score<Candidates, Args...>::value...});
+                    static_assert(sel.nb_best > 0, "No implementation accepts the named arguments passed");
+                    static_assert(sel.nb_best < 2, "Ambiguous call: several implementations require as many of the named arguments passed");
+                    return sel.index;
+                }
+
+            indexed_storage<std::index_sequence_for<Candidates...>, Candidates...> m_candidates;
+        };
+
+        template <typename... ArgTypes> struct with_t
+        {
+            template <typename F>
+                constexpr
+                candidate<typename std::decay<F>::type, ArgTypes...> operator()(F&& f) const
+                { return {std::forward<F>(f)}; }
+        };
+    } // internals namespace
+
+    /**
+     * Declares the parameters an implementation requires, see \c na::overload().
+     */
+    template <typename... ArgTypes>
+        constexpr
+        internals::with_t<ArgTypes...> with(ArgTypes const&...)
+        {
+            static_assert(internals::all_of<internals::is_string_literal<ArgTypes>::value...>::value,
+                    "Only parameter names (\"name\"_na) can be required");
+            return {};
+        }
+
+    /**
+     * Selects at compile time an implementation depending on the parameters
+     * passed.
+     * \code
+     * auto sort = na::overload(
+     *     na::with("presorted"_na)(sort_presorted),
+     *     na::with("hint"_na, "cmp"_na)(sort_with_hint),
+     *     sort_general); // no requirement
+     * \endcode
+     * - An implementation is viable when all the parameters it requires are
+     *   passed.
+     * - The viable implementation that requires the most parameters is chosen.
+     * - If several viable implementations require as many parameters, the
+     *   call is ambiguous.
+     */
+    template <typename... Fs>
+        constexpr
+        internals::overload_t<typename internals::as_candidate<typename std::decay<Fs>::type>::type...>
+        overload(Fs&&... fs)
+        {
+            return internals::overload_t<typename internals::as_candidate<typename std::decay<Fs>::type>::type...>{
+                internals::as_candidate<typename std::decay<Fs>::type>::make(std::forward<Fs>(fs))...};
+        }
+
+    // Canonical ordering of the parameters
+    namespace internals
+    {
+        template <typename T, typename = void>
+            struct is_named_argument : std::false_type {};
+        template <typename T>
+            struct is_named_argument<T, void_t<typename clean_type<T>::type::ArgumentTypeId>>
+            : std::true_type {};
+
+        template <typename CharT>
+            constexpr bool lexicographical_less(
+                    std::initializer_list<CharT> lhs, std::initializer_list<CharT> rhs)
+            {
+                auto l = lhs.begin();
+                auto r = rhs.begin();
+                for ( ; l != lhs.end() && r != rhs.end() ; ++l, ++r) {
+                    if (*l < *r) return true;
+                    if (*r < *l) return false;
+                }
+                return l == lhs.end() && r != rhs.end();
+            }
+
+        /// Order on the character types of parameter names.
+        template <typename CharT> struct char_type_rank;
+        template <> struct char_type_rank<char>     : std::integral_constant<int, 0> {};
+#if defined(__cpp_char8_t)
+        template <> struct char_type_rank<char8_t>  : std::integral_constant<int, 1> {};
+#endif
+        template <> struct char_type_rank<char16_t> : std::integral_constant<int, 2> {};
+        template <> struct char_type_rank<char32_t> : std::integral_constant<int, 3> {};
+        template <> struct char_type_rank<wchar_t>  : std::integral_constant<int, 4> {};
+
+        /// Order on parameter names: by character type, then lexicographical.
+        template <typename ArgType1, typename ArgType2> struct name_less;
+        template <typename CharT1, CharT1...lhs, typename CharT2, CharT2...rhs>
+            struct name_less<literals::string_literal<CharT1, lhs...>, literals::string_literal<CharT2, rhs...>>
+            : std::integral_constant<bool, (char_type_rank<CharT1>::value < char_type_rank<CharT2>::value)>
+            {};
+        template <typename CharT, CharT...lhs, CharT...rhs>
+            struct name_less<literals::string_literal<CharT, lhs...>, literals::string_literal<CharT, rhs...>>
+            : std::integral_constant<bool, lexicographical_less<CharT>({lhs...}, {rhs...})>
+            {};
+
+        constexpr std::size_t sum(std::initializer_list<std::size_t> values)
+        {
+            std::size_t res = 0;
+            for (auto v : values) res += v;
+            return res;
+        }
+
+        template <typename Arg> using arg_typeid_t
+            = typename get_arg_typeid<typename clean_type<Arg>::type>::type;
+
+        /**
+         * Position of the I-th parameter once all the parameters are sorted.
+         * Parameters passed several times keep their relative order: the
+         * callee diagnoses them if it reads them, as with a direct call.
+         */
+        template <std::size_t I, typename ArgType, typename Indices, typename... Args> struct rank;
+        template <std::size_t I, typename ArgType, std::size_t... J, typename... Args>
+            struct rank<I, ArgType, std::index_sequence<J...>, Args...>
+            : std::integral_constant<std::size_t,
+              sum({std::size_t(name_less<arg_typeid_t<Args>, ArgType>::value
+                      || (J < I && std::is_same<arg_typeid_t<Args>, ArgType>::value))...})>
+            {};
+
+        template <typename ArgType, typename... Args>
+            struct nb_instances : std::integral_constant<std::size_t,
+              sum({std::size_t(std::is_same<arg_typeid_t<Args>, ArgType>::value)...})>
+            {};
+
+        template <std::size_t N> struct index_array
+        {
+            std::size_t values[N];
+        };
+        template <> struct index_array<0> {};
+
+        /// Indices of the parameters, sorted by name.
+        template <std::size_t N>
+            constexpr index_array<N> canonical_order(std::initializer_list<std::size_t> ranks)
+            {
+                index_array<N> res{};
+                std::size_t i = 0;
+                for (auto r : ranks)
+                    res.values[r] = i++;
+                return res;
+            }
+        template <>
+            constexpr index_array<0> canonical_order<0>(std::initializer_list<std::size_t>)
+            { return {}; }
+
+        template <std::size_t I> struct nth_arg
+        {
+            template <typename Arg0, typename... Args>
+                static constexpr decltype(auto) get(Arg0&&, Args&&... tail)
+                { return nth_arg<I-1>::get(std::forward<Args>(tail)...); }
+        };
+        template <> struct nth_arg<0>
+        {
+            template <typename Arg0, typename... Args>
+                static constexpr Arg0&& get(Arg0&& head, Args&&...)
+                { return std::forward<Arg0>(head); }
+        };
+
+        template <typename F, std::size_t... K, typename... Args>
+            inline
+            decltype(auto) canonical_call_impl(std::index_sequence<K...>, F&& f, Args&&... args)
+            {
+                static_assert(all_of<is_named_argument<Args>::value...>::value,
+                        "Only named arguments can be reordered");
+                constexpr auto order = canonical_order<sizeof...(Args)>(
+                        {rank<K, arg_typeid_t<Args>, std::index_sequence<K...>, Args...>::value...});
+                (void) order; // unused when there are no parameters
+                return std::forward<F>(f)(nth_arg<order.values[K]>::get(std::forward<Args>(args)...)...);
+            }
+
+        template <typename F> struct canonical_t
+        {
+            template <typename... Args>
+                decltype(auto) operator()(Args&&... args) const;
+
+            F f;
+        };
+    } // internals namespace
+
+    /**
+     * Calls \c f with the parameters sorted by name.
+     * As all the permutations of the same parameters are passed in the same
+     * order, \c f is instantiated only once for all of them:
+     * \code
+     * na::canonical_call(f, "a"_na = 1, "b"_na = 2);
+     * na::canonical_call(f, "b"_na = 2, "a"_na = 1); // same f instance
+     * \endcode
+     */
+    template <typename F, typename... Args>
+        inline
+        decltype(auto) canonical_call(F&& f, Args&&... args)
+        {
+            return internals::canonical_call_impl(
+                    std::index_sequence_for<Args...>{},
+                    std::forward<F>(f), std::forward<Args>(args)...);
+        }
+
+    template <typename F>
+        template <typename... Args>
+        inline
+        decltype(auto) internals::canonical_t<F>::operator()(Args&&... args) const
+        {
+            return canonical_call(f, std::forward<Args>(args)...);
+        }
+
+    /// Wraps \c f into a function object that sorts its parameters, see
+    /// \c na::canonical_call().
+    template <typename F>
+        constexpr
+        internals::canonical_t<typename std::decay<F>::type> canonical(F&& f)
+        { return {std::forward<F>(f)}; }
+
+    // Named template parameters
+    /**
+     * Named template argument: a parameter kind bound to a type.
+     * \code
+     * using fnv_hash = na::targ<decltype("hash"_na), Fnv>;
+     * \endcode
+     */
+    template <typename ArgType, typename T> struct targ
+    {
+        using ArgumentTypeId = ArgType;
+        using ArgumentType   = T;
+    };
+
+    /// Named template argument bound to a compile-time constant.
+    template <typename ArgType, typename T, T v>
+        using tvalue = targ<ArgType, std::integral_constant<T, v>>;
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    /// C++20 shorter form of \c na::targ: `na::type<"hash"_na, Fnv>`.
+    // NB: template parameter objects are const
+    template <auto name, typename T>
+        using type = targ<typename std::remove_const<decltype(name)>::type, T>;
+
+    /// C++20 shorter form of \c na::tvalue: `na::value<"slots"_na, 64>`.
+    template <auto name, auto v>
+        using value = type<name, std::integral_constant<decltype(v), v>>;
+#endif
+
+    /**
+     * List of named template arguments to instantiate a class template with:
+     * \code
+     * my_table<na::tparams<
+     *     na::targ<decltype("hash"_na), Fnv>,
+     *     na::tvalue<decltype("slots"_na), std::size_t, 64>>>
+     * \endcode
+     */
+    template <typename... TArgs> struct tparams {};
+
+    namespace internals
+    {
+        template <typename T> struct is_targ : std::false_type {};
+        template <typename ArgType, typename T>
+            struct is_targ<targ<ArgType, T>> : std::true_type {};
+
+        // Compile-time constants shall be compatible, other types are
+        // policies that can't be compared.
+        template <typename Default, typename T,
+                 bool = is_static_flag<Default>::value,
+                 bool = is_static_flag<T>::value>
+            struct are_tcompatible
+            : std::integral_constant<bool, ! is_static_flag<Default>::value && ! is_static_flag<T>::value> {};
+        template <typename Default, typename T>
+            struct are_tcompatible<Default, T, true, true>
+            : has_common<typename Default::value_type, typename T::value_type> {};
+
+        template <bool Found, typename ArgType, typename Default, typename... TArgs>
+            struct tget_impl;
+
+        // End of recursion: past last element
+        // -> default value, optional parameter
+        template <typename ArgType, typename Default>
+            struct tget_impl<false, ArgType, Default>
+            {
+                using type = Default;
+            };
+        // -> no default value, mandatory parameter
+        template <typename ArgType>
+            struct tget_impl<false, ArgType, no_default>
+            {
+                static_assert(wrong_t<ArgType>::value, "This parameter is mandatory, no default value is acceptable");
+                using type = Invalid;
+            };
+
+        // Not found => recurse
+        template <typename ArgType, typename Default, typename TArg0, typename... TArgs>
+            struct tget_impl<false, ArgType, Default, TArg0, TArgs...>
+            : tget_impl<head_is_matching<ArgType, TArgs...>::value, ArgType, Default, TArgs...>
+            {};
+
+        // Found!
+        template <typename ArgType, typename Default, typename TArg0, typename... TArgs>
+            struct tget_impl<true, ArgType, Default, TArg0, TArgs...>
+            {
+                static_assert(! is_passed<ArgType, TArgs...>::value, "A parameter cannot be instanciated several times");
+                static_assert(
+                        doesnt_have_a_default<Default>::value ||
+                        are_tcompatible<Default, typename TArg0::ArgumentType>::value,
+                        "The parameter passed and the default value declared don't have compatible types!");
+                using type = typename TArg0::ArgumentType;
+            };
+
+        template <typename ArgType, typename Default, typename... TArgs>
+            struct tget_front
+            : tget_impl<head_is_matching<ArgType, TArgs...>::value, ArgType, Default, TArgs...>
+            {
+                static_assert(all_of<is_targ<TArgs>::value...>::value,
+                        "Only named template arguments (na::targ) can be passed to na::tparams");
+            };
+    } // internals namespace
+
+    /**
+     * Fetches a named template argument.
+     * @tparam Spec  either a parameter kind, e.g. `decltype("hash"_na)`, for
+     *               mandatory parameters, or a \c na::targ that specifies the
+     *               default type.
+     * @tparam TParams \c na::tparams<> list
+     * \code
+     * template <typename TParams> struct my_table {
+     *     using hash = na::tget_t<decltype("hash"_na), TParams>;
+     *     static constexpr std::size_t slots
+     *         = na::tget_t<na::tvalue<decltype("slots"_na), std::size_t, 16>, TParams>::value;
+     * };
+     * \endcode
+     */
+    template <typename Spec, typename TParams> struct tget;
+
+    template <typename CharT, CharT...string, typename... TArgs>
+        struct tget<literals::string_literal<CharT, string...>, tparams<TArgs...>>
+        : internals::tget_front<literals::string_literal<CharT, string...>, internals::no_default, TArgs...>
+        {};
+
+    template <typename ArgType, typename Default, typename... TArgs>
+        struct tget<targ<ArgType, Default>, tparams<TArgs...>>
+        : internals::tget_front<ArgType, Default, TArgs...>
+        {};
+
+    template <typename Spec, typename TParams>
+        using tget_t = typename tget<Spec, TParams>::type;
+
+    // Layered packs of parameters
+    namespace internals
+    {
+        template <bool... b> struct any_of
+            : std::integral_constant<bool, ! all_of<! b...>::value> {};
+
+        /// Type through which a value stored in a pack is read: never an
+        /// rvalue, and const unless the parameter is a modifiable lvalue.
+        template <typename T> struct lvalue_of      { using type = T const&; };
+        template <typename T> struct lvalue_of<T&>  { using type = T&; };
+
+        /**
+         * Parameter stored in a pack: lvalues are referenced, rvalues are
+         * moved into the pack.
+         * Its value is read through a proxy to an lvalue. This way, reading
+         * a pack never moves its values out, and const packs cannot be
+         * modified.
+         */
+        template <typename T, bool Output, class CharT, CharT...string> struct packed
+        {
+            using ArgumentTypeId = literals::string_literal<CharT, string...>;
+            using ArgumentType   = T;
+            using proxy_type     = typename std::conditional<Output,
+                  literals::out_proxy<typename lvalue_of<T>::type, CharT, string...>,
+                  literals::proxy    <typename lvalue_of<T>::type, CharT, string...>
+                  >::type;
+
+            constexpr proxy_type as_proxy() const { return proxy_type{m_v}; }
+
+            T m_v;
+        };
+
+        template <typename T> struct packed_type
+        { using type = typename std::remove_cv<T>::type; };
+        template <typename T> struct packed_type<T&>
+        { using type = T&; };
+
+        template <typename Proxy> struct packed_of;
+        template <typename T, class CharT, CharT...string>
+            struct packed_of<literals::proxy<T, CharT, string...>>
+            {
+                static_assert(! std::is_array<T>::value, "Arrays can only be packed as lvalues");
+                using type = packed<typename packed_type<T>::type, false, CharT, string...>;
+            };
+        template <typename T, class CharT, CharT...string>
+            struct packed_of<literals::out_proxy<T, CharT, string...>>
+            {
+                using type = packed<T, true, CharT, string...>;
+            };
+
+        /// Parameters stored to be fetched later, see \c na::pack().
+        template <typename... Entries> struct pack_t
+        {
+            constexpr explicit pack_t(Entries... es)
+                : m_entries(std::move(es)...)
+                {}
+
+            template <typename ArgType, typename Default>
+                auto&& get(Default&& default_) const
+                {
+                    return get_in<ArgType>(std::forward<Default>(default_), std::index_sequence_for<Entries...>{});
+                }
+
+            template <typename ArgType>
+                auto get_out() const
+                {
+                    return get_out_in<ArgType>(std::index_sequence_for<Entries...>{});
+                }
+
+        private:
+            template <typename ArgType, typename Default, std::size_t... I>
+                auto&& get_in(Default&& default_, std::index_sequence<I...>) const
+                {
+                    using same_head = typename head_is_matching<ArgType, Entries...>::type;
+                    return get_impl<ArgType>(std::forward<Default>(default_), same_head{}, get_holder<I>(m_entries).as_proxy()...);
+                }
+
+            template <typename ArgType, std::size_t... I>
+                auto get_out_in(std::index_sequence<I...>) const
+                {
+                    using same_head = typename head_is_matching<ArgType, Entries...>::type;
+                    return get_out_impl<ArgType>(same_head{}, get_holder<I>(m_entries).as_proxy()...);
+                }
+
+            indexed_storage<std::index_sequence_for<Entries...>, Entries...> m_entries;
+        };
+
+        /// Index of the last layer that contains a parameter, or the number of
+        /// layers if none does.
+        constexpr std::size_t last_of(std::initializer_list<bool> contained)
+        {
+            std::size_t res = contained.size();
+            std::size_t i = 0;
+            for (bool c : contained) {
+                if (c) res = i;
+                ++i;
+            }
+            return res;
+        }
+
+        /// Layers of parameters, see \c na::merge().
+        template <typename... Layers> struct merged_t
+        {
+            constexpr explicit merged_t(Layers... ls)
+                : m_layers(std::forward<Layers>(ls)...)
+                {}
+
+            template <typename ArgType, typename Default>
+                auto&& get(Default&& default_) const
+                {
+                    constexpr std::size_t idx = last_of({contains<typename clean_type<Layers>::type, ArgType>::value...});
+                    return get_at<ArgType>(std::forward<Default>(default_),
+                            std::integral_constant<std::size_t, idx>{},
+                            std::integral_constant<bool, (idx < sizeof...(Layers))>{});
+                }
+
+            template <typename ArgType>
+                auto get_out() const
+                {
+                    constexpr std::size_t idx = last_of({contains<typename clean_type<Layers>::type, ArgType>::value...});
+                    return get_out_at<ArgType>(
+                            std::integral_constant<std::size_t, idx>{},
+                            std::integral_constant<bool, (idx < sizeof...(Layers))>{});
+                }
+
+        private:
+            // Found in a layer => search in it
+            template <typename ArgType, typename Default, std::size_t I>
+                auto&& get_at(Default&& default_, std::integral_constant<std::size_t, I>, std::true_type) const
+                {
+                    return get_holder<I>(m_layers).template get<ArgType>(std::forward<Default>(default_));
+                }
+            // Not found => default value, or mandatory parameter missing
+            template <typename ArgType, typename Default, std::size_t I>
+                auto&& get_at(Default&& default_, std::integral_constant<std::size_t, I>, std::false_type) const
+                {
+                    return get_impl<ArgType>(std::forward<Default>(default_), std::false_type{});
+                }
+
+            // Output parameter found in a layer => search in it
+            template <typename ArgType, std::size_t I>
+                auto get_out_at(std::integral_constant<std::size_t, I>, std::true_type) const
+                {
+                    return get_holder<I>(m_layers).template get_out<ArgType>();
+                }
+            // Not found => the output parameter isn't requested
+            template <typename ArgType, std::size_t I>
+                no_output get_out_at(std::integral_constant<std::size_t, I>, std::false_type) const
+                {
+                    return {};
+                }
+
+            indexed_storage<std::index_sequence_for<Layers...>, Layers...> m_layers;
+        };
+
+        template <typename... Entries, typename ArgType>
+            struct contains<pack_t<Entries...>, ArgType>
+            : is_passed<ArgType, Entries...> {};
+        template <typename... Layers, typename ArgType>
+            struct contains<merged_t<Layers...>, ArgType>
+            : any_of<contains<typename clean_type<Layers>::type, ArgType>::value...> {};
+
+        template <typename... Entries> struct is_layered<pack_t<Entries...>> : std::true_type {};
+        template <typename... Layers> struct is_layered<merged_t<Layers...>> : std::true_type {};
+
+        template <typename T> using enable_if_layered_t
+            = typename std::enable_if<is_layered<typename clean_type<T>::type>::value>::type;
+
+        // lvalue layers are referenced, rvalue layers are moved.
+        template <typename Layer> struct layer_storage
+        { using type = Layer; };
+        template <typename Layer> struct layer_storage<Layer&>
+        { using type = Layer const&; };
+    } // internals namespace
+
+    /**
+     * Stores parameters in order to fetch them later.
+     * The parameters bound to lvalues are referenced: they shall outlive the
+     * pack. The parameters bound to rvalues are moved into the pack.
+     */
+    template <typename... Args>
+        constexpr
+        auto pack(Args&&... args)
+        {
+            static_assert(internals::all_of<internals::is_named_argument<Args>::value...>::value,
+                    "Only named arguments can be packed");
+            return internals::pack_t<typename internals::packed_of<typename internals::clean_type<Args>::type>::type...>{
+                {std::forward<Args>(args).value()}...};
+        }
+
+    /**
+     * Layers packs of parameters: parameters in later layers shadow the
+     * parameters with the same name in earlier layers.
+     * \code
+     * auto const defaults = na::pack("timeout"_na = 30, "retries"_na = 3);
+     * auto const tenant   = na::pack("timeout"_na = 10);
+     * auto       args     = na::merge(defaults, tenant, na::pack("retries"_na = 5));
+     * auto timeout = na::get("timeout"_na, args); // 10
+     * \endcode
+     * Lvalue layers are referenced, rvalue layers are moved, and merged views
+     * can be merged again.
+     */
+    template <typename... Layers>
+        constexpr
+        internals::merged_t<typename internals::layer_storage<Layers>::type...>
+        merge(Layers&&... layers)
+        {
+            static_assert(internals::all_of<internals::is_layered<typename internals::clean_type<Layers>::type>::value...>::value,
+                    "Only na::pack() and na::merge() results can be merged");
+            return internals::merged_t<typename internals::layer_storage<Layers>::type...>{
+                std::forward<Layers>(layers)...};
+        }
+
+    /// Fetches a parameter from a pack or a merged view.
+    template <typename CharT, CharT...string, typename Layers,
+             typename = internals::enable_if_layered_t<Layers>>
+        inline
+        auto&& get(literals::string_literal<CharT, string...> const&, Layers&& layers)
+        {
+            using ArgType = literals::string_literal<CharT, string...>;
+            return layers.template get<ArgType>(internals::no_default{});
+        }
+    // Proxy => default value
+    template <typename T, typename CharT, CharT...string, typename Layers,
+             typename = internals::enable_if_layered_t<Layers>>
+        inline
+        auto&& get(literals::proxy<T, CharT, string...> const& default_, Layers&& layers)
+        {
+            using ArgType = literals::string_literal<CharT, string...>;
+            return layers.template get<ArgType>(default_.value());
+        }
+
+    /// Fetches an output parameter from a pack or a merged view.
+    template <typename CharT, CharT...string, typename Layers,
+             typename = internals::enable_if_layered_t<Layers>>
+        inline
+        auto get_out(literals::string_literal<CharT, string...> const&, Layers&& layers)
+        {
+            using ArgType = literals::string_literal<CharT, string...>;
+            return layers.template get_out<ArgType>();
+        }
 } // na namespaces
 
 #endif // NAMED_PARAMETERS_HPP
@@ -0,0 +1,27 @@
+/**@file        modules/named-parameters.cppm
+ * @author      Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// C++20 module interface unit for named parameters.
+//
+// Usage:
+//     import named_parameters;
+//     using namespace na::literals;
+//
+// The standard headers the core header depends on are included in the global
+// module fragment. The core header is then included in the module purview
+// with all its declarations exported.
+module;
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+export module named_parameters;
+
+#define NAMED_PARAMETERS_EXPORT export
+#include "named-parameters.hpp"
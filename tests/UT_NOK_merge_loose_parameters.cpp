@@ -0,0 +1,31 @@
+/**@file	tests/UT_NOK_merge_loose_parameters.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+template <typename ...Args>
+int f(Args&& ...args)
+{
+    return na::get("t"_na, std::forward<Args>(args)...)
+        +  na::get("u"_na, std::forward<Args>(args)...);
+}
+
+// ===[ merge_loose_parameters ]============================== {{{1
+BOOST_AUTO_TEST_CASE(merge_loose_parameters)
+{
+    auto const defaults = na::pack("t"_na = 1);
+    BOOST_CHECK_EQUAL(f(defaults, "u"_na = 2), 3); // na::merge() expected
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -0,0 +1,26 @@
+/**@file	tests/UT_NOK_merge_missing_mandatory.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+
+// ===[ merge_missing_mandatory ]============================= {{{1
+BOOST_AUTO_TEST_CASE(merge_missing_mandatory)
+{
+    auto const defaults = na::pack("a"_na = 1);
+    auto const tenant   = na::pack("b"_na = 2);
+    auto c = na::get("c"_na, na::merge(defaults, tenant));
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -0,0 +1,32 @@
+/**@file	tests/UT_NOK_output_not_wrapped.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+
+// ===[ output_not_wrapped ]================================== {{{1
+template <typename ...Args>
+void f_output(Args&& ...args)
+{
+    auto res = na::get_out("res"_na, std::forward<Args>(args)...);
+    res = 42;
+}
+
+BOOST_AUTO_TEST_CASE(output_not_wrapped)
+{
+    int res = 0;
+    f_output("res"_na = res); // na::out() is missing
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
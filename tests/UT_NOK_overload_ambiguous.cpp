@@ -0,0 +1,28 @@
+/**@file	tests/UT_NOK_overload_ambiguous.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+
+// ===[ overload_ambiguous ]=========================== {{{1
+auto const f = na::overload(
+        na::with("hint"_na)([](auto&& ...) { return 1; }),
+        na::with("presorted"_na)([](auto&& ...) { return 2; }));
+
+BOOST_AUTO_TEST_CASE(overload_ambiguous)
+{
+    f("hint"_na = 1, "presorted"_na = true); // both implementations are viable
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -0,0 +1,28 @@
+/**@file	tests/UT_NOK_overload_no_match.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+
+// ===[ overload_no_match ]============================ {{{1
+auto const f = na::overload(
+        na::with("hint"_na)([](auto&& ...) { return 1; }),
+        na::with("presorted"_na)([](auto&& ...) { return 2; }));
+
+BOOST_AUTO_TEST_CASE(overload_no_match)
+{
+    f("data"_na = 1); // no implementation is viable
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -0,0 +1,30 @@
+/**@file	tests/UT_NOK_static_flag_runtime.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+
+// ===[ static_flag_runtime ]================================= {{{1
+template <typename ...Args>
+void f_static_flag(Args&& ...args)
+{
+    auto checked = na::get("checked"_na = na::static_flag<bool, false>, std::forward<Args>(args)...);
+}
+
+BOOST_AUTO_TEST_CASE(static_flag_runtime)
+{
+    f_static_flag("checked"_na = true); // run-time value
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
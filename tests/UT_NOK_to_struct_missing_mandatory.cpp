@@ -0,0 +1,33 @@
+/**@file	tests/UT_NOK_to_struct_missing_mandatory.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters-struct.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+struct Options {
+    int n = 4;
+    int m;
+};
+constexpr auto na_fields(na::type_tag<Options>) {
+    return na::fields(
+            na::field   ("n"_na, &Options::n),
+            na::required("m"_na, &Options::m));
+}
+
+// ===[ to_struct_missing_mandatory ]========================= {{{1
+BOOST_AUTO_TEST_CASE(to_struct_missing_mandatory)
+{
+    auto o = na::to_struct<Options>("n"_na = 42);
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
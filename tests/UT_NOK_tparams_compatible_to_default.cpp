@@ -0,0 +1,33 @@
+/**@file	tests/UT_NOK_tparams_compatible_to_default.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+struct Fnv {};
+
+template <typename TParams>
+struct my_table
+{
+    static constexpr std::size_t slots
+        = na::tget_t<na::tvalue<decltype("slots"_na), std::size_t, 16>, TParams>::value;
+};
+
+// ===[ tparams_compatible_to_default ]============== {{{1
+BOOST_AUTO_TEST_CASE(tparams_compatible_to_default)
+{
+    using t = my_table<na::tparams<na::targ<decltype("slots"_na), Fnv>>>; // a type instead of a value
+    BOOST_CHECK_EQUAL(std::size_t(t::slots), 16);
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -0,0 +1,32 @@
+/**@file	tests/UT_NOK_tparams_missing_mandatory.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+#define BOOST_TEST_MODULE "Named parameters related tests"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+
+using namespace na::literals;
+
+template <typename TParams>
+struct my_table
+{
+    using hash = na::tget_t<decltype("hash"_na), TParams>;
+    static constexpr int slots
+        = na::tget_t<na::tvalue<decltype("slots"_na), int, 16>, TParams>::value;
+};
+
+// ===[ tparams_missing_mandatory ]================== {{{1
+BOOST_AUTO_TEST_CASE(tparams_missing_mandatory)
+{
+    using t = my_table<na::tparams<na::tvalue<decltype("slots"_na), int, 64>>>; // no hash
+    typename t::hash h{};
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -9,9 +9,14 @@
 #define BOOST_TEST_DYN_LINK
 
 #include "named-parameters.hpp"
+#include "named-parameters-string.hpp"
+#include "named-parameters-struct.hpp"
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <vector>
 #include <complex>
+#include <sstream>
+#include <tuple>
 
 using namespace na::literals;
 
@@ -343,6 +348,528 @@ BOOST_AUTO_TEST_CASE(rvref_cref_ref)
     // BOOST_CHECK_EQUAL(v.size(), 6); // check v was copied
 }
 
+// ===[ by_value_storage ]========================================= {{{1
+template <typename T> struct stored_by_value_of;
+template <typename T, typename CharT, CharT...string>
+struct stored_by_value_of<na::literals::proxy<T, CharT, string...>>
+: std::integral_constant<bool, na::literals::proxy<T, CharT, string...>::stored_by_value>
+{};
+template <typename P> constexpr bool stored_by_value(P const&)
+{ return stored_by_value_of<P>::value; }
+
+template <typename ...Args>
+constexpr bool f_is_get_rvalue(Args&& ...args)
+{
+    return std::is_rvalue_reference<decltype(na::get("a"_na, std::forward<Args>(args)...))>::value;
+}
+
+struct MoveOnly {
+    MoveOnly(int v_) : v(v_) {}
+    MoveOnly(MoveOnly const&) = delete;
+    MoveOnly(MoveOnly&&) = default;
+    int v;
+};
+
+BOOST_AUTO_TEST_CASE(by_value_storage)
+{
+    auto       i  = 42;
+    auto const ci = 42;
+    auto       s  = std::string{"foo"};
+    // small trivially copyable rvalues are stored by value
+    BOOST_CHECK(stored_by_value("a"_na = 42));
+    BOOST_CHECK(stored_by_value("a"_na = 12.5));
+    BOOST_CHECK(stored_by_value("a"_na = std::move(i)));
+    // lvalues, const rvalues, and other types are stored by reference
+    BOOST_CHECK(!stored_by_value("a"_na = i));
+    BOOST_CHECK(!stored_by_value("a"_na = ci));
+    BOOST_CHECK(!stored_by_value("a"_na = std::move(ci)));
+    BOOST_CHECK(!stored_by_value("a"_na = std::move(s)));
+    BOOST_CHECK(!stored_by_value("a"_na = std::complex<long double>{}));
+    int arr[2] = {1, 2};
+    BOOST_CHECK(!stored_by_value("a"_na = std::move(arr)));
+    // small move-only types are moved into the proxy
+    BOOST_CHECK(stored_by_value("a"_na = MoveOnly{3}));
+    f_copy_no_default1(
+            [](MoveOnly const& m) { BOOST_CHECK_EQUAL(m.v, 3); },
+            "a"_na=MoveOnly{3});
+    f_reference_no_default1(
+            [](auto && a) { BOOST_CHECK_EQUAL(a[1], 2); },
+            "a"_na=std::move(arr));
+
+    // references are still references
+    f_reference_no_default1(
+            [](auto && a) { BOOST_CHECK_EQUAL(a, 42); a+=1; },
+            "a"_na=i);
+    BOOST_CHECK_EQUAL(i, 43);
+    // values stored are seen as rvalues
+    BOOST_CHECK(f_is_get_rvalue("a"_na=12.5));
+    BOOST_CHECK(!f_is_get_rvalue("a"_na=i));
+    f_copy_no_default1(
+            [](double a) { BOOST_CHECK_EQUAL(a, 12.5); },
+            "a"_na=12.5);
+    // unless the proxy is const: it cannot be modified
+    auto const cp = "a"_na = 12.5;
+    BOOST_CHECK(!f_is_get_rvalue(cp));
+    static_assert(std::is_same<decltype(cp.value()), double const&>::value,
+            "A const proxy shall not give a modifiable access to its value");
+}
+
+// ===[ name_and_stream ]========================================== {{{1
+BOOST_AUTO_TEST_CASE(name_and_stream)
+{
+    BOOST_CHECK_EQUAL(na::name("foo"_na), "foo");
+    BOOST_CHECK_EQUAL(na::name("bar"_na = 42), "bar");
+    BOOST_CHECK_EQUAL(decltype("foo"_na)::size, 3);
+
+    std::ostringstream oss;
+    auto i = 12;
+    oss << "foo"_na << ", " << ("bar"_na = i);
+    BOOST_CHECK_EQUAL(oss.str(), "foo, bar=12");
+}
+
+// ===[ to_struct ]================================================ {{{1
+namespace ns {
+    struct Options {
+        int              n = 4;
+        double           x = 12.5;
+        std::string      s;
+        std::vector<int> v;
+    };
+    constexpr auto na_fields(na::type_tag<Options>) {
+        return na::fields(
+                na::field   ("n"_na, &Options::n),
+                na::field   ("x"_na, &Options::x),
+                na::required("s"_na, &Options::s),
+                na::field   ("v"_na, &Options::v));
+    }
+
+    // Counts how the instances are built
+    struct Counted {
+        Counted(int v_) : v(v_) {}
+        Counted(Counted const& o) : v(o.v) { ++nb_copies; }
+        Counted(Counted&& o) : v(o.v) { ++nb_moves; }
+        Counted& operator=(Counted const&) = delete;
+        Counted& operator=(Counted&&) = delete;
+        int v;
+        static int nb_copies;
+        static int nb_moves;
+    };
+    int Counted::nb_copies = 0;
+    int Counted::nb_moves  = 0;
+
+    struct Bound {
+        int const  id;
+        Counted    c;
+        double     ratio = 0.5;
+    };
+    constexpr auto na_fields(na::type_tag<Bound>) {
+        return na::fields(
+                na::required("id"_na, &Bound::id),
+                na::required("c"_na,  &Bound::c));
+    }
+} // ns namespace
+
+template <typename ...Args>
+ns::Options f_to_struct(Args&& ...args)
+{
+    return na::to_struct<ns::Options>(std::forward<Args>(args)...);
+}
+
+BOOST_AUTO_TEST_CASE(to_struct)
+{
+    // defaults
+    auto const o1 = f_to_struct("s"_na = "foo");
+    BOOST_CHECK_EQUAL(o1.n, 4);
+    BOOST_CHECK_EQUAL(o1.x, 12.5);
+    BOOST_CHECK_EQUAL(o1.s, "foo");
+    BOOST_CHECK(o1.v.empty());
+
+    // unsorted, with unrelated parameters
+    auto       v  = std::vector<int>{ 1, 2, 3};
+    auto const o2 = f_to_struct("x"_na = 1.5, "s"_na = std::string{"bar"}, "v"_na = std::move(v), "z"_na = 0, "n"_na = 42);
+    BOOST_CHECK_EQUAL(o2.n, 42);
+    BOOST_CHECK_EQUAL(o2.x, 1.5);
+    BOOST_CHECK_EQUAL(o2.s, "bar");
+    BOOST_CHECK_EQUAL(o2.v.size(), 3);
+    BOOST_CHECK(v.empty()); // check v was moved
+
+    // arithmetic values are converted
+    auto const o3 = f_to_struct("s"_na = "foo", "x"_na = 2);
+    BOOST_CHECK_EQUAL(o3.x, 2.0);
+
+    // each field is built once: const and non-assignable members are supported
+    auto c = ns::Counted{42};
+    auto const b1 = na::to_struct<ns::Bound>("c"_na = std::move(c), "id"_na = 1);
+    BOOST_CHECK_EQUAL(b1.id, 1);
+    BOOST_CHECK_EQUAL(b1.c.v, 42);
+    BOOST_CHECK_EQUAL(b1.ratio, 0.5); // left out => default member initializer
+    BOOST_CHECK_EQUAL(ns::Counted::nb_moves, 1);
+    BOOST_CHECK_EQUAL(ns::Counted::nb_copies, 0);
+    auto const b2 = na::to_struct<ns::Bound>("c"_na = c, "id"_na = 2);
+    BOOST_CHECK_EQUAL(ns::Counted::nb_moves, 1);
+    BOOST_CHECK_EQUAL(ns::Counted::nb_copies, 1);
+    BOOST_CHECK_EQUAL(b2.id, 2);
+}
+
+// ===[ output_parameters ]======================================== {{{1
+template <typename ...Args>
+int f_output_parameters(int & nb_computations, Args&& ...args)
+{
+    auto const  in   = na::get("in"_na, std::forward<Args>(args)...);
+    auto        sum  = na::get_out("sum"_na, std::forward<Args>(args)...);
+    auto        sqrs = na::get_out("squares"_na, std::forward<Args>(args)...);
+    sum = in + 1;
+    na::if_requested(sqrs, [&](auto & out) {
+            ++nb_computations;
+            out.clear();
+            for (int i = 0; i != in; ++i)
+                out.push_back(i*i);
+            });
+    return decltype(sum)::requested + decltype(sqrs)::requested;
+}
+
+BOOST_AUTO_TEST_CASE(output_parameters)
+{
+    int nb_computations = 0;
+    int sum = 0;
+    std::vector<int> squares;
+
+    // all outputs requested
+    BOOST_CHECK_EQUAL(2, f_output_parameters(nb_computations,
+                na::out("squares"_na = squares), "in"_na = 4, na::out("sum"_na = sum)));
+    BOOST_CHECK_EQUAL(sum, 5);
+    BOOST_CHECK_EQUAL(squares.size(), 4);
+    BOOST_CHECK_EQUAL(squares[3], 9);
+    BOOST_CHECK_EQUAL(nb_computations, 1);
+
+    // only one output requested: the other isn't computed
+    BOOST_CHECK_EQUAL(1, f_output_parameters(nb_computations,
+                "in"_na = 2, na::out("sum"_na = sum)));
+    BOOST_CHECK_EQUAL(sum, 3);
+    BOOST_CHECK_EQUAL(squares.size(), 4);
+    BOOST_CHECK_EQUAL(nb_computations, 1);
+
+    // no output requested
+    BOOST_CHECK_EQUAL(0, f_output_parameters(nb_computations, "in"_na = 2));
+
+    // output parameters can still be fetched as references
+    f_reference_no_default1(
+            [](auto && a) { a = 42; },
+            na::out("a"_na = sum));
+    BOOST_CHECK_EQUAL(sum, 42);
+
+    auto o = na::get_out("a"_na, na::out("a"_na = sum));
+    static_assert(decltype(o)::requested, "output expected");
+    *o = 12;
+    BOOST_CHECK_EQUAL(sum, 12);
+    BOOST_CHECK(static_cast<bool>(o));
+    BOOST_CHECK(!na::get_out("a"_na, "b"_na = 1));
+
+    // the flags can be odr-used
+    auto n = na::get_out("a"_na, "b"_na = 1);
+    bool const& o_requested = decltype(o)::requested;
+    bool const& n_requested = decltype(n)::requested;
+    BOOST_CHECK(o_requested);
+    BOOST_CHECK(!n_requested);
+    BOOST_CHECK_EQUAL(std::max(decltype(o)::requested, decltype(n)::requested), true);
+    BOOST_CHECK_EQUAL(decltype(n)::requested, false);
+
+    // assigning a handle to another one writes through, it doesn't rebind
+    int x = 0;
+    int y = 0;
+    auto o1 = na::get_out("x"_na, na::out("x"_na = x));
+    auto o2 = na::get_out("y"_na, na::out("y"_na = y));
+    *o2 = 3;
+    o1 = o2;
+    BOOST_CHECK_EQUAL(x, 3);
+    o1 = 5;
+    BOOST_CHECK_EQUAL(x, 5);
+    BOOST_CHECK_EQUAL(y, 3);
+    o1 = std::move(o2);
+    BOOST_CHECK_EQUAL(x, 3);
+    auto o3 = o1; // copies are bound to the same parameter
+    o3 = 7;
+    BOOST_CHECK_EQUAL(x, 7);
+}
+
+// ===[ static_flag ]============================================== {{{1
+// C++14: specialization through tag dispatching
+int checked_impl(int i, std::true_type ) { return i < 0 ? 0 : i; }
+int checked_impl(int i, std::false_type) { return i; }
+
+template <typename ...Args>
+int f_static_flag(Args&& ...args)
+{
+    auto checked = na::get("checked"_na = na::static_flag<bool, false>, std::forward<Args>(args)...);
+    auto i       = na::get("i"_na, std::forward<Args>(args)...);
+    return checked_impl(i, checked);
+}
+
+BOOST_AUTO_TEST_CASE(static_flag)
+{
+    BOOST_CHECK_EQUAL(f_static_flag("i"_na = -1), -1);
+    BOOST_CHECK_EQUAL(f_static_flag("i"_na = -1, "checked"_na = na::static_flag<bool, false>), -1);
+    BOOST_CHECK_EQUAL(f_static_flag("checked"_na = na::static_flag<bool, true>, "i"_na = -1), 0);
+    BOOST_CHECK_EQUAL(f_static_flag("checked"_na = std::true_type{}, "i"_na = -1), 0);
+
+    // compile-time flags can be passed to run-time parameters
+    f_copy_with_default1(
+            [](auto && a) { BOOST_CHECK_EQUAL(a, 42); },
+            "a"_na=na::static_flag<int, 42>);
+}
+
+// ===[ is_set ]=================================================== {{{1
+template <typename ...Args>
+constexpr bool f_is_set(Args&& ...args)
+{
+    return decltype(na::is_set("a"_na, std::forward<Args>(args)...))::value;
+}
+
+BOOST_AUTO_TEST_CASE(is_set)
+{
+    auto i = 0;
+    BOOST_CHECK(!f_is_set());
+    BOOST_CHECK(!f_is_set("b"_na = 1));
+    BOOST_CHECK( f_is_set("b"_na = 1, "a"_na = i));
+    BOOST_CHECK( f_is_set(na::out("a"_na = i)));
+}
+
+// ===[ overload ]================================================= {{{1
+struct impl_general {
+    template <typename ...Args>
+    std::string operator()(Args&& ...args) const {
+        auto&& data = na::get("data"_na, std::forward<Args>(args)...);
+        return "general:" + std::to_string(data);
+    }
+};
+
+auto const f_overload = na::overload(
+        na::with("presorted"_na)(
+            [](auto&& ...args) {
+            auto&& data = na::get("data"_na, std::forward<decltype(args)>(args)...);
+            return "presorted:" + std::to_string(data);
+            }),
+        na::with("hint"_na, "cmp"_na)(
+            [](auto&& ...args) {
+            auto&& hint = na::get("hint"_na, std::forward<decltype(args)>(args)...);
+            return "hint_cmp:" + std::to_string(hint);
+            }),
+        na::with("hint"_na)(
+            [](auto&& ...args) {
+            auto&& hint = na::get("hint"_na, std::forward<decltype(args)>(args)...);
+            return "hint:" + std::to_string(hint);
+            }),
+        impl_general{});
+
+BOOST_AUTO_TEST_CASE(overload)
+{
+    BOOST_CHECK_EQUAL(f_overload("data"_na = 1), "general:1");
+    BOOST_CHECK_EQUAL(f_overload("data"_na = 1, "presorted"_na = true), "presorted:1");
+    BOOST_CHECK_EQUAL(f_overload("hint"_na = 2, "data"_na = 1), "hint:2");
+    // the most specialized implementation wins
+    BOOST_CHECK_EQUAL(f_overload("cmp"_na = 0, "hint"_na = 2, "data"_na = 1), "hint_cmp:2");
+    // incomplete requirements
+    BOOST_CHECK_EQUAL(f_overload("cmp"_na = 0, "data"_na = 1), "general:1");
+
+    auto copy = f_overload;
+    BOOST_CHECK_EQUAL(copy("data"_na = 1, "presorted"_na = true), "presorted:1");
+
+    // stateful implementations
+    auto counter = na::overload(
+            na::with("step"_na)([n = 0](auto&& ...args) mutable {
+                return n += na::get("step"_na, std::forward<decltype(args)>(args)...);
+                }),
+            [n = 0](auto&& ...) mutable { return ++n; });
+    BOOST_CHECK_EQUAL(counter(), 1);
+    BOOST_CHECK_EQUAL(counter(), 2);
+    BOOST_CHECK_EQUAL(counter("step"_na = 10), 10);
+    BOOST_CHECK_EQUAL(counter("step"_na = 10), 20);
+}
+
+// ===[ canonical_call ]=========================================== {{{1
+struct f_canonical_call {
+    template <typename ...Args>
+    std::string operator()(int & nb_instances, Args&& ...args) const {
+        static int const id = ++nb_instances;
+        (void) id;
+        auto && a = na::get("a"_na       , std::forward<Args>(args)...);
+        auto && b = na::get("b"_na       , std::forward<Args>(args)...);
+        auto && c = na::get("c"_na = "c0", std::forward<Args>(args)...);
+        return a + b + c;
+    }
+};
+
+template <typename ...Args>
+std::string f_canonical(int & nb_instances, Args&& ...args)
+{
+    auto impl = [&](auto&& ...sorted_args) {
+        return f_canonical_call{}(nb_instances, std::forward<decltype(sorted_args)>(sorted_args)...);
+    };
+    return na::canonical_call(impl, std::forward<Args>(args)...);
+}
+
+BOOST_AUTO_TEST_CASE(canonical_call)
+{
+    int nb_instances = 0;
+    std::string const a = "a";
+    std::string       b = "b";
+    BOOST_CHECK_EQUAL(f_canonical(nb_instances, "a"_na = a, "b"_na = b), "abc0");
+    BOOST_CHECK_EQUAL(f_canonical(nb_instances, "b"_na = b, "a"_na = a), "abc0");
+    BOOST_CHECK_EQUAL(nb_instances, 1);
+
+    BOOST_CHECK_EQUAL(f_canonical(nb_instances, "a"_na = a, "c"_na = "c", "b"_na = b), "abc");
+    BOOST_CHECK_EQUAL(f_canonical(nb_instances, "b"_na = b, "a"_na = a, "c"_na = "c"), "abc");
+    BOOST_CHECK_EQUAL(f_canonical(nb_instances, "c"_na = "c", "b"_na = b, "a"_na = a), "abc");
+    BOOST_CHECK_EQUAL(nb_instances, 2);
+
+    // names sharing a prefix
+    auto const sorted = na::canonical([](auto&& ...args) {
+            return sizeof...(args) == 3 && std::is_same<
+                decltype(std::make_tuple(args...)),
+                std::tuple<decltype("ab"_na = 1), decltype("abc"_na = 2), decltype("b"_na = 3)>
+                >::value;
+            });
+    BOOST_CHECK(sorted("abc"_na = 2, "b"_na = 3, "ab"_na = 1));
+    BOOST_CHECK(sorted("b"_na = 3, "ab"_na = 1, "abc"_na = 2));
+
+    // names with different character types: sorted by character type first
+    auto const by_char_type = na::canonical([](auto&& ...args) {
+            return std::is_same<
+                decltype(std::make_tuple(args...)),
+                std::tuple<decltype("b"_na = 2), decltype(u"a"_na = 1)>
+                >::value;
+            });
+    BOOST_CHECK(by_char_type(u"a"_na = 1, "b"_na = 2));
+    BOOST_CHECK(by_char_type("b"_na = 2, u"a"_na = 1));
+    BOOST_CHECK_EQUAL(na::canonical_call(
+                [](auto&& ...args) { return na::get(u"a"_na, std::forward<decltype(args)>(args)...); },
+                u"a"_na = 1, "b"_na = 2), 1);
+
+    // parameters passed several times keep their relative order, and are
+    // accepted as long as the callee doesn't read them
+    auto const duplicates = na::canonical([](auto&& ...args) {
+            auto const& a = na::get("a"_na, std::forward<decltype(args)>(args)...);
+            auto const& b = std::get<1>(std::forward_as_tuple(args...)).value();
+            auto const& c = std::get<2>(std::forward_as_tuple(args...)).value();
+            return a + ":" + std::to_string(b) + ":" + std::to_string(c);
+            });
+    BOOST_CHECK_EQUAL(duplicates("b"_na = 1, "a"_na = std::string("foo"), "b"_na = 2), "foo:1:2");
+    BOOST_CHECK_EQUAL(duplicates("b"_na = 2, "b"_na = 1, "a"_na = std::string("foo")), "foo:2:1");
+}
+
+// ===[ tparams ]================================================== {{{1
+struct Fnv {};
+template <typename TParams>
+struct my_table
+{
+    using hash = na::tget_t<decltype("hash"_na), TParams>;
+    static constexpr std::size_t slots
+        = na::tget_t<na::tvalue<decltype("slots"_na), std::size_t, 16>, TParams>::value;
+    static constexpr std::size_t align
+        = na::tget_t<na::tvalue<decltype("align"_na), std::size_t, alignof(void*)>, TParams>::value;
+    using layout = na::tget_t<na::targ<decltype("layout"_na), std::false_type>, TParams>;
+};
+
+BOOST_AUTO_TEST_CASE(tparams)
+{
+    using t1 = my_table<na::tparams<
+        na::targ<decltype("hash"_na), Fnv>
+        >>;
+    static_assert(std::is_same<t1::hash, Fnv>::value, "");
+    static_assert(t1::slots == 16, "");
+    static_assert(t1::align == alignof(void*), "");
+    static_assert(std::is_same<t1::layout, std::false_type>::value, "");
+
+    // unsorted, compatible values, and unrelated parameters
+    using t2 = my_table<na::tparams<
+        na::tvalue<decltype("align"_na), int, 64>,
+        na::targ<decltype("layout"_na), std::true_type>,
+        na::targ<decltype("foo"_na), void>,
+        na::targ<decltype("hash"_na), std::hash<int>>,
+        na::tvalue<decltype("slots"_na), std::size_t, 64>
+        >>;
+    static_assert(std::is_same<t2::hash, std::hash<int>>::value, "");
+    static_assert(t2::slots == 64, "");
+    static_assert(t2::align == 64, "");
+    static_assert(std::is_same<t2::layout, std::true_type>::value, "");
+    BOOST_CHECK_EQUAL(std::size_t(t2::slots), 64);
+}
+
+// ===[ merge ]==================================================== {{{1
+template <typename ...Args>
+std::string f_merge(Args&& ...args)
+{
+    auto timeout = na::get("timeout"_na      , std::forward<Args>(args)...);
+    auto retries = na::get("retries"_na = 1  , std::forward<Args>(args)...);
+    auto const& name = na::get("name"_na = "", std::forward<Args>(args)...);
+    return std::string(name) + ":" + std::to_string(timeout) + ":" + std::to_string(retries);
+}
+
+BOOST_AUTO_TEST_CASE(merge)
+{
+    std::string const name = "svc";
+    auto const defaults = na::pack("timeout"_na = 30, "retries"_na = 3);
+    auto const tenant   = na::pack("name"_na = name, "timeout"_na = 10);
+
+    BOOST_CHECK_EQUAL(f_merge(defaults), ":30:3");
+    BOOST_CHECK_EQUAL(f_merge(tenant),   "svc:10:1");
+
+    // later layers shadow earlier ones
+    auto const cfg = na::merge(defaults, tenant);
+    BOOST_CHECK_EQUAL(f_merge(cfg), "svc:10:3");
+    BOOST_CHECK_EQUAL(f_merge(na::merge(cfg, na::pack("retries"_na = 5))), "svc:10:5");
+    BOOST_CHECK_EQUAL(f_merge(na::merge(tenant, defaults)), "svc:30:3");
+
+    // the originals are referenced
+    BOOST_CHECK_EQUAL(&na::get("name"_na, cfg), &name);
+    auto       i   = 0;
+    auto const ref = na::pack("i"_na = i);
+    na::get("i"_na, na::merge(defaults, ref)) = 42;
+    BOOST_CHECK_EQUAL(i, 42);
+
+    // values are never moved out of packs: they can be read several times
+    auto       s     = std::string{"svc"};
+    auto const moved = na::pack("name"_na = std::move(s), "timeout"_na = 5);
+    BOOST_CHECK_EQUAL(f_merge(moved), "svc:5:1");
+    BOOST_CHECK_EQUAL(f_merge(moved), "svc:5:1");
+    BOOST_CHECK_EQUAL(na::get("name"_na, moved), "svc");
+    BOOST_CHECK_EQUAL(na::get("name"_na, moved), "svc");
+    std::string const copy = na::get("name"_na, na::merge(defaults, moved));
+    BOOST_CHECK_EQUAL(copy, "svc");
+
+    // rvalues are moved into packs, lvalues are referenced
+    auto const owner = na::pack("name"_na = std::string("owned"), "timeout"_na = 5, "retries"_na = i);
+    BOOST_CHECK_EQUAL(f_merge(owner), "owned:5:42");
+    BOOST_CHECK_NE(&na::get("name"_na, moved), &s);
+    BOOST_CHECK_EQUAL(&na::get("retries"_na, owner), &i);
+
+    // and values that aren't modifiable lvalues cannot be modified
+    static_assert(std::is_same<decltype(na::get("timeout"_na, defaults)), int const&>::value,
+            "const packs shall not be modifiable");
+    static_assert(std::is_same<decltype(na::get("name"_na, moved)), std::string const&>::value,
+            "const packs shall not be modifiable");
+    static_assert(std::is_same<decltype(na::get("i"_na, ref)), int&>::value,
+            "modifiable lvalues shall stay modifiable");
+
+    // packs can be passed to all the functions that understand named
+    // parameters
+    BOOST_CHECK(na::is_set("timeout"_na, cfg));
+    BOOST_CHECK(!na::is_set("t"_na, cfg));
+    BOOST_CHECK_EQUAL(f_overload(na::merge(cfg, na::pack("data"_na = 1))), "general:1");
+    BOOST_CHECK_EQUAL(f_overload(na::pack("data"_na = 1, "hint"_na = 2)), "hint:2");
+    auto const opt = na::to_struct<ns::Options>(na::merge(tenant, na::pack("s"_na = "foo")));
+    BOOST_CHECK_EQUAL(opt.n, 4);
+    BOOST_CHECK_EQUAL(opt.s, "foo");
+
+    int  sum = 0;
+    auto const outs = na::merge(defaults, na::pack(na::out("sum"_na = sum)));
+    auto o = na::get_out("sum"_na, outs);
+    static_assert(decltype(o)::requested, "output expected");
+    o = 12;
+    BOOST_CHECK_EQUAL(sum, 12);
+    static_assert(!decltype(na::get_out("squares"_na, outs))::requested, "no output expected");
+}
+
 // ===[ reference_with_default5 ]==================================== {{{1
 #if 0
 // References are not compatible with default value!
@@ -0,0 +1,48 @@
+/**@file	tests/UT_OK_cxx17.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// Tests of the features that require C++17.
+#define BOOST_TEST_MODULE "Named parameters related tests (C++17)"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using namespace na::literals;
+
+// ===[ static_flag_if_constexpr ]============================ {{{1
+enum class Layout { AoS, SoA };
+
+template <typename ...Args>
+int f_static_flag(Args&& ...args)
+{
+    auto checked = na::get("checked"_na = na::c<false>      , std::forward<Args>(args)...);
+    auto layout  = na::get("layout"_na  = na::c<Layout::AoS>, std::forward<Args>(args)...);
+    auto i       = na::get("i"_na, std::forward<Args>(args)...);
+    static_assert(std::is_same<typename decltype(checked)::value_type, bool>::value, "");
+    static_assert(std::is_same<typename decltype(layout)::value_type, Layout>::value, "");
+
+    if constexpr (checked) {
+        if (i < 0) i = 0;
+    }
+    if constexpr (layout == Layout::SoA) {
+        i *= 10;
+    }
+    return i;
+}
+
+BOOST_AUTO_TEST_CASE(static_flag_if_constexpr)
+{
+    BOOST_CHECK_EQUAL(f_static_flag("i"_na = -1), -1);
+    BOOST_CHECK_EQUAL(f_static_flag("i"_na = -1, "checked"_na = na::c<true>), 0);
+    BOOST_CHECK_EQUAL(f_static_flag("layout"_na = na::c<Layout::SoA>, "i"_na = 2), 20);
+    BOOST_CHECK_EQUAL(f_static_flag("layout"_na = na::c<Layout::SoA>, "i"_na = -2, "checked"_na = na::c<true>), 0);
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker:
@@ -0,0 +1,47 @@
+/**@file	tests/UT_OK_cxx20.cpp
+ * @author	Luc Hermitte <EMAIL:luc{dot}hermitte{at}gmail{dot}com>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+// Tests of the features that require C++20.
+#define BOOST_TEST_MODULE "Named parameters related tests (C++20)"
+#define BOOST_TEST_DYN_LINK
+
+#include "named-parameters.hpp"
+#include <boost/test/unit_test.hpp>
+#include <functional>
+
+using namespace na::literals;
+
+// ===[ tparams_short_forms ]================================= {{{1
+struct Fnv {};
+template <typename TParams>
+struct my_table
+{
+    using hash = na::tget_t<decltype("hash"_na), TParams>;
+    static constexpr std::size_t slots
+        = na::tget_t<na::value<"slots"_na, std::size_t{16}>, TParams>::value;
+    using layout = na::tget_t<na::type<"layout"_na, std::false_type>, TParams>;
+};
+
+BOOST_AUTO_TEST_CASE(tparams_short_forms)
+{
+    using t1 = my_table<na::tparams<na::type<"hash"_na, Fnv>>>;
+    static_assert(std::is_same_v<t1::hash, Fnv>);
+    static_assert(t1::slots == 16);
+    static_assert(std::is_same_v<t1::layout, std::false_type>);
+
+    using t2 = my_table<na::tparams<
+        na::value<"slots"_na, 64>,
+        na::type<"layout"_na, std::true_type>,
+        na::type<"hash"_na, std::hash<int>>
+        >>;
+    static_assert(std::is_same_v<t2::hash, std::hash<int>>);
+    static_assert(std::is_same_v<t2::layout, std::true_type>);
+    BOOST_CHECK_EQUAL(t2::slots, 64);
+}
+
+// =========================================================== }}}1
+// vim:set fdm=marker: